@@ -0,0 +1,156 @@
+#include <stdio.h>
+#include <algorithm>
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hardware/structs/systick.h"
+#include "AS5600/AS5600.h"
+
+// Benchmark Settings
+static const uint     SDA_PIN        = 0;
+static const uint     SCL_PIN        = 1;
+static const uint32_t WARMUP_CALLS   = 16;
+static const uint32_t SAMPLE_CALLS   = 1000;
+
+static const uint32_t I2C_CLOCKS[]   = { 100000, 400000, 1000000 };
+
+static const uint32_t SYSTICK_MASK   = 0x00FFFFFF;
+
+static uint32_t latencies[SAMPLE_CALLS];
+
+// Methods Under Test
+// Each entry performs exactly one driver call and returns its success
+// Setters write back the saved configuration, so the sensor is never changed
+// and only run when the configuration could be read first
+struct BenchMethod {
+    const char *name;
+    bool (*call)(AS5600 &sensor, AS5600::Config &saved);
+    bool writesConfig;
+};
+
+static bool ok(AS5600 &sensor) { return sensor.getLastErrorCode() == AS5600::AS5600_OK; }
+
+static const BenchMethod METHODS[] = {
+    { "readAngleRaw<RawData>", [](AS5600 &s, AS5600::Config &) { s.readAngleRaw<RawData>(); return ok(s); }, false },
+    { "readAngleRaw<Degrees>", [](AS5600 &s, AS5600::Config &) { s.readAngleRaw<Degrees>(); return ok(s); }, false },
+    { "readAngleRaw<Radians>", [](AS5600 &s, AS5600::Config &) { s.readAngleRaw<Radians>(); return ok(s); }, false },
+    { "readAngle<RawData>",    [](AS5600 &s, AS5600::Config &) { s.readAngle<RawData>();    return ok(s); }, false },
+    { "readAngle<Degrees>",    [](AS5600 &s, AS5600::Config &) { s.readAngle<Degrees>();    return ok(s); }, false },
+    { "readAngle<Radians>",    [](AS5600 &s, AS5600::Config &) { s.readAngle<Radians>();    return ok(s); }, false },
+    { "getStatus",             [](AS5600 &s, AS5600::Config &) { s.getStatus();             return ok(s); }, false },
+    { "readAGC",               [](AS5600 &s, AS5600::Config &) { s.readAGC();               return ok(s); }, false },
+    { "readMagnitude",         [](AS5600 &s, AS5600::Config &) { s.readMagnitude();         return ok(s); }, false },
+    { "setPowerMode",          [](AS5600 &s, AS5600::Config &c) { return s.setPowerMode(c.powerMode);     }, true  },
+    { "setHysteresis",         [](AS5600 &s, AS5600::Config &c) { return s.setHysteresis(c.hysteresis);   }, true  },
+    { "setOutputMode",         [](AS5600 &s, AS5600::Config &c) { return s.setOutputMode(c.outputStage);  }, true  },
+    { "setPWMFrequency",       [](AS5600 &s, AS5600::Config &c) { return s.setPWMFrequency(c.pwmFreq);    }, true  },
+    { "setSlowFilter",         [](AS5600 &s, AS5600::Config &c) { return s.setSlowFilter(c.slowFilter);   }, true  },
+    { "setFastFilter",         [](AS5600 &s, AS5600::Config &c) { return s.setFastFilter(c.fastFilter);   }, true  },
+    { "setWatchdog",           [](AS5600 &s, AS5600::Config &c) { return s.setWatchdog(c.watchdog);       }, true  },
+    { "setConfiguration",      [](AS5600 &s, AS5600::Config &c) { return s.setConfiguration(c);           }, true  },
+};
+
+// @brief  Run SysTick free from clk_sys over its full 24-bit range
+static void systickInit() {
+    systick_hw->csr = 0;
+    systick_hw->rvr = SYSTICK_MASK;
+    systick_hw->cvr = 0;
+    systick_hw->csr = (1 << 2) | (1 << 0);  // CLKSOURCE = processor clock, ENABLE
+}
+
+// @brief  Get latency percentile from a sorted sample buffer
+// @param  p Percentile (0 - 100)
+static uint32_t percentile(const uint32_t *sorted, uint32_t count, uint32_t p) {
+    uint32_t index = (count * p) / 100;
+    if (index >= count) index = count - 1;
+
+    return sorted[index];
+}
+
+// @brief  Run one method at the current bus clock and print its report line
+static void runMethod(AS5600 &sensor, AS5600::Config &saved, const BenchMethod &method, uint32_t busHz) {
+    uint32_t errors = 0;
+    uint64_t cycles = 0;
+
+    for (uint32_t i = 0; i < WARMUP_CALLS; ++i) method.call(sensor, saved);
+
+    uint64_t start = time_us_64();
+
+    for (uint32_t i = 0; i < SAMPLE_CALLS; ++i) {
+        uint32_t t0 = time_us_32();
+        uint32_t c0 = systick_hw->cvr;
+
+        if (!method.call(sensor, saved)) ++errors;
+
+        uint32_t c1 = systick_hw->cvr;
+        latencies[i] = time_us_32() - t0;
+
+        cycles += (c0 - c1) & SYSTICK_MASK;     // SysTick counts down and wraps every 2^24 cycles
+    }
+
+    uint64_t elapsed = time_us_64() - start;
+    if (elapsed == 0) elapsed = 1;
+
+    std::sort(latencies, latencies + SAMPLE_CALLS);
+
+    float samplesPerSecond = (SAMPLE_CALLS * 1000000.0f) / elapsed;
+    float cyclesPerSample  = (float)cycles / SAMPLE_CALLS;
+
+    printf("%lu,%s,%lu,%lu,%.1f,%lu,%lu,%lu,%lu,%lu,%.0f\n",
+           (unsigned long)busHz,
+           method.name,
+           (unsigned long)SAMPLE_CALLS,
+           (unsigned long)errors,
+           samplesPerSecond,
+           (unsigned long)latencies[0],
+           (unsigned long)percentile(latencies, SAMPLE_CALLS, 50),
+           (unsigned long)percentile(latencies, SAMPLE_CALLS, 90),
+           (unsigned long)percentile(latencies, SAMPLE_CALLS, 99),
+           (unsigned long)latencies[SAMPLE_CALLS - 1],
+           cyclesPerSample);
+}
+
+int main()
+{
+    stdio_init_all();
+    sleep_ms(2000);                          // Give the USB host time to attach
+
+    gpio_set_function(SDA_PIN, GPIO_FUNC_I2C);
+    gpio_set_function(SCL_PIN, GPIO_FUNC_I2C);
+    gpio_pull_up(SDA_PIN);
+    gpio_pull_up(SCL_PIN);
+
+    AS5600 sensor(i2c0);
+
+    uint32_t sysHz = clock_get_hz(clk_sys);
+
+    systickInit();
+
+    while (true) {
+
+        // Save the current configuration, the setters write it back unchanged
+        i2c_init(i2c0, 100000);
+        AS5600::Config saved;
+        bool restore = sensor.getConfiguration(saved);
+
+        printf("# pico-AS5600-bench sys_hz=%lu calls=%lu warmup=%lu\n",
+               (unsigned long)sysHz, (unsigned long)SAMPLE_CALLS, (unsigned long)WARMUP_CALLS);
+        if (!restore) printf("# configuration read failed, skipping config setters\n");
+
+        printf("bus_hz,method,calls,errors,samples_per_s,min_us,p50_us,p90_us,p99_us,max_us,cycles_per_sample\n");
+
+        for (uint32_t busHz : I2C_CLOCKS) {
+            uint32_t actualHz = i2c_init(i2c0, busHz);
+
+            for (const BenchMethod &method : METHODS) {
+                if (method.writesConfig && !restore) continue;
+                runMethod(sensor, saved, method, actualHz);
+            }
+        }
+
+        i2c_init(i2c0, 100000);
+        if (restore && !sensor.setConfiguration(saved)) printf("# configuration restore failed\n");
+
+        printf("# done\n\n");
+        sleep_ms(10000);
+    }
+}
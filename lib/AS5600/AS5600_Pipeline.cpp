@@ -0,0 +1,192 @@
+#include "AS5600_Pipeline.h"
+
+// @brief  Shortest signed distance from one 12-bit angle to another
+static int16_t wrap_delta(uint16_t from, uint16_t to) {
+    return (int16_t)(((to - from + 2048) & 0x0FFF) - 2048);
+}
+
+static int16_t median3(int16_t a, int16_t b, int16_t c) {
+    if (a > b) { int16_t t = a; a = b; b = t; }
+    if (b > c) { b = c; }
+    return (a > b) ? a : b;
+}
+
+// @brief  Signed division rounded to nearest
+static int32_t round_div(int32_t num, uint32_t den) {
+    if (num >= 0) return  (int32_t)(((uint32_t)num  + den / 2) / den);
+    return               -(int32_t)(((uint32_t)-num + den / 2) / den);
+}
+
+
+/* @brief  Add a decimating subscriber tap
+ * @param  decimation Output one sample every `decimation` inputs (1 = pass-through)
+ * @param  order      Number of CIC stages (1 = boxcar average)
+ * @param  callback   Called with every output sample, may be nullptr
+ * @param  context    Passed through to the callback
+ * @param  source     SOURCE_INPUT, or the index of an earlier tap to cascade from
+ * @return Tap index, or -1 if the tap could not be added
+ * @note   Cascading from a failed addTap (-1) also fails
+ * @note   decimation ^ order must not exceed MAX_GAIN
+ */
+int8_t AS5600Pipeline::addTap(uint16_t decimation, uint8_t order, Callback callback, void *context, int8_t source) {
+    if (tapCount >= MAX_TAPS)                       return -1;
+    if (decimation == 0)                            return -1;
+    if (order == 0 || order > MAX_ORDER)            return -1;
+    if (source != SOURCE_INPUT && (source < 0 || source >= tapCount)) return -1;
+
+    uint32_t gain = 1;
+    for (uint8_t i = 0; i < order; ++i) {
+        gain *= decimation;
+        if (gain > MAX_GAIN)                        return -1;
+    }
+
+    Tap &tap = taps[tapCount];
+
+    tap.source     = source;
+    tap.decimation = decimation;
+    tap.order      = order;
+    tap.gain       = gain;
+    tap.callback   = callback;
+    tap.context    = context;
+    tap.primed     = false;
+    tap.valid      = false;
+    tap.count      = 0;
+    tap.last       = {};
+
+    return tapCount++;
+}
+
+
+/* @brief  Feed one raw angle sample through the pipeline
+ * @param  raw Raw angle (0 - 4095), e.g. from readAngleRaw<RawData>()
+ * @note   The glitch filter is a recursive median of three, so outputs lag the input by one sample.
+ *         A sample is replaced by the median only when it deviates from it by more
+ *         than the glitch threshold (0 = always use the median).
+ *         The first sample only primes the filter and produces no output.
+ */
+void AS5600Pipeline::push(uint16_t raw) {
+    raw &= 0x0FFF;
+
+    if (!primed) {
+        pending = raw;
+        primed  = true;
+        return;
+    }
+
+    // No previous output yet, so the first sample is checked against the second alone
+    if (!running) {
+        lastAngle = raw;
+        position  = raw;
+        running   = true;
+    }
+
+    // Median of (last output, current, next), unwrapped around the last output
+    int16_t  current = wrap_delta(lastAngle, pending);
+    int16_t  median  = median3(0, current, wrap_delta(lastAngle, raw));
+
+    pending = raw;
+
+    int16_t  step  = current;
+    int16_t  error = median - current;
+
+    if ((error < 0 ? -error : error) > glitchThreshold) {
+        step = median;
+        ++glitchCount;
+    }
+
+    position  = (int32_t)((uint32_t)position + step);
+    lastAngle = (lastAngle + step) & 0x0FFF;
+
+    bool produced[MAX_TAPS];
+
+    for (uint8_t i = 0; i < tapCount; ++i) {
+        Tap &tap = taps[i];
+        produced[i] = false;
+
+        int32_t in;
+        if      (tap.source == SOURCE_INPUT) in = position;
+        else if (produced[tap.source])       in = taps[tap.source].last.position;
+        else continue;
+
+        int32_t out;
+        if (!_decimate(tap, in, out)) continue;
+
+        tap.last.position = out;
+        tap.last.angle    = (uint16_t)(out & 0x0FFF);
+        tap.last.index   += 1;
+        tap.valid         = true;
+        produced[i]       = true;
+
+        if (tap.callback) tap.callback(tap.last, tap.context);
+    }
+}
+
+// @brief  Read one raw angle from the sensor and feed it through the pipeline
+// @return false if the register read failed, the sample is then discarded
+bool AS5600Pipeline::update(AS5600 &sensor) {
+    uint16_t raw = sensor.readAngleRaw<RawData>();
+
+    if (sensor.getLastErrorCode() != AS5600::AS5600_OK) return false;
+
+    push(raw);
+    return true;
+}
+
+// @brief  Get the latest output of a tap
+// @return false if the tap does not exist or has not produced a sample yet
+bool AS5600Pipeline::getSample(uint8_t tap, Sample &sample) {
+    if (tap >= tapCount || !taps[tap].valid) return false;
+
+    sample = taps[tap].last;
+    return true;
+}
+
+// @brief  Clear all filter state, keeping the configured taps
+void AS5600Pipeline::reset() {
+    primed      = false;
+    running     = false;
+    glitchCount = 0;
+
+    for (uint8_t i = 0; i < tapCount; ++i) {
+        taps[i].primed = false;
+        taps[i].valid  = false;
+        taps[i].count  = 0;
+        taps[i].last   = {};
+    }
+}
+
+
+/* @brief  Run one input through a tap's CIC decimator
+ * @return true when an output sample was produced
+ * @note   Integrators and combs wrap modulo 2^32. The output is recovered as the
+ *         latest input plus the rounded mean deviation from it, which stays exact
+ *         as long as gain * deviation fits in 31 bits (speed limit in AS5600_Pipeline.h).
+ */
+bool AS5600Pipeline::_decimate(Tap &tap, int32_t in, int32_t &out) {
+    if (!tap.primed) {
+        for (uint8_t i = 0; i < tap.order; ++i) tap.integrator[i] = tap.comb[i] = 0;
+        tap.offset = in;
+        tap.primed = true;
+    }
+
+    // Relative to the first input, so start-up history reads as a constant position
+    uint32_t x = (uint32_t)in - (uint32_t)tap.offset;
+
+    tap.integrator[0] += x;
+    for (uint8_t i = 1; i < tap.order; ++i) tap.integrator[i] += tap.integrator[i - 1];
+
+    if (++tap.count < tap.decimation) return false;
+    tap.count = 0;
+
+    uint32_t y = tap.integrator[tap.order - 1];
+    for (uint8_t i = 0; i < tap.order; ++i) {
+        uint32_t prev = tap.comb[i];
+        tap.comb[i] = y;
+        y -= prev;
+    }
+
+    int32_t deviation = (int32_t)(y - tap.gain * x);
+
+    out = (int32_t)((uint32_t)in + round_div(deviation, tap.gain));
+    return true;
+}
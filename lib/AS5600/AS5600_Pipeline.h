@@ -0,0 +1,94 @@
+#ifndef __AS5600_PIPELINE__
+#define __AS5600_PIPELINE__
+
+#include "AS5600.h"
+
+// Multi-rate processing pipeline for the AS5600 raw angle stream.
+// One bus read per input sample feeds a wrap-aware glitch filter, followed by
+// any number of cascaded integer decimators (CIC / boxcar) with subscriber taps.
+//
+// Sample::position wraps modulo 2^32 (about 524k turns). Compare positions by
+// their difference, e.g. (int32_t)((uint32_t)a - (uint32_t)b), never directly.
+//
+// A tap's output is exact only while
+//     decimation^order * order * (decimation - 1) / 2 * speed < 2^31
+// with speed in counts per tap input sample. addTap(256, 2), for example, is
+// limited to about 128 counts per input sample.
+
+class AS5600Pipeline {
+
+    public:
+
+        static constexpr uint8_t  MAX_TAPS  = 4;
+        static constexpr uint8_t  MAX_ORDER = 4;
+        static constexpr uint32_t MAX_GAIN  = 65536;  // decimation ^ order
+
+        static constexpr int8_t   SOURCE_INPUT = -2;  // Distinct from the -1 error return of addTap
+
+        struct Sample {
+            uint16_t angle;     // Wrapped angle (0 - 4095)
+            int32_t  position;  // Unwrapped position, 4096 counts per turn, wraps modulo 2^32
+            uint32_t index;     // Number of samples produced by this tap
+        };
+
+        typedef void (*Callback)(const Sample &sample, void *context);
+
+    private:
+
+        struct Tap {
+            int8_t   source;
+            uint16_t decimation;
+            uint8_t  order;
+            uint32_t gain;
+            uint16_t count;
+            bool     primed;
+            bool     valid;
+            int32_t  offset;
+            uint32_t integrator[MAX_ORDER];
+            uint32_t comb[MAX_ORDER];
+            Sample   last;
+            Callback callback;
+            void    *context;
+        };
+
+        Tap      taps[MAX_TAPS];
+        uint8_t  tapCount = 0;
+
+        uint16_t glitchThreshold;
+        uint32_t glitchCount = 0;
+
+        bool     primed = false;
+        bool     running = false;
+        uint16_t pending;
+        uint16_t lastAngle;
+        int32_t  position;
+
+        bool     _decimate(Tap &tap, int32_t in, int32_t &out);
+
+    public:
+
+        AS5600Pipeline(uint16_t glitchThreshold = 0) {
+            AS5600Pipeline::glitchThreshold = glitchThreshold;
+        };
+
+        int8_t   addTap(uint16_t decimation, uint8_t order, Callback callback = nullptr,
+                        void *context = nullptr, int8_t source = SOURCE_INPUT);
+
+        void     push(uint16_t raw);
+        bool     update(AS5600 &sensor);
+
+        bool     getSample(uint8_t tap, Sample &sample);
+
+        void     setGlitchThreshold(uint16_t threshold) {
+            glitchThreshold = threshold;
+        };
+
+        uint32_t getGlitchCount() {
+            return glitchCount;
+        };
+
+        void     reset();
+
+};
+
+#endif
@@ -17,7 +17,7 @@ int main()
     AS5600 sensor(i2c0);
     
     while (true) {
-        printf("%d\n", sensor.readAngleRaw()); // Print raw angle data over serial
+        printf("%d\n", sensor.readAngleRaw<RawData>()); // Print raw angle data over serial
         sleep_ms(5);
     }
 }
\ No newline at end of file